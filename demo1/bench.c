@@ -0,0 +1,409 @@
+#include <time.h>
+#include <unistd.h>
+#include "main.h"
+
+#define DEFAULT_SAMPLES 2000
+#define WARMUP_SAMPLES 50
+
+struct Result {
+    const char* op;
+    int rows;
+    int cols;
+    int fill;
+    int samples;
+    double mean;
+    long p50;
+    long p99;
+};
+
+struct Bench {
+    struct Game* game;
+    char** template;
+    int samples;
+    long* times;
+    struct Result* results;
+    int numResults;
+};
+
+typedef void (*Op)(struct Game* game, int row, int col);
+
+/**
+ * Gets the current monotonic time.
+ * @return The time in nanoseconds.
+ */
+long now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000L + ts.tv_nsec;
+}
+
+/**
+ * Comparison used to sort the sample timings.
+ * @param a The first timing.
+ * @param b The second timing.
+ * @return The ordering of the two timings.
+ */
+int compare_times(const void* a, const void* b) {
+    long x = *(const long*)a;
+    long y = *(const long*)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * Creates a game with a generated board. Corners are blank, edges
+ * are empty zero value tiles and the interior has random values
+ * with the given percentage of tiles already taken.
+ * @param rows The number of rows in the board.
+ * @param cols The number of columns in the board.
+ * @param fill The percentage of interior tiles to fill.
+ * @param seed The seed used to generate the board.
+ * @return The generated game.
+ */
+struct Game* generate_game(int rows, int cols, int fill, unsigned int seed) {
+    struct Game* game = calloc(1, sizeof(struct Game));
+    game->rows = malloc(sizeof(int));
+    game->cols = malloc(sizeof(int));
+    *game->rows = rows;
+    *game->cols = cols;
+    game->player1 = '0';
+    game->player2 = '1';
+    game->curTurn = 'O';
+
+    game->board = malloc(sizeof(char*) * rows);
+    for (int i = 0; i < rows; ++i) {
+        game->board[i] = malloc(sizeof(char) * cols * 2);
+        for (int j = 0; j < cols; ++j) {
+            bool corner = (i == 0 || i == rows - 1) &&
+                    (j == 0 || j == cols - 1);
+            bool edge = i == 0 || i == rows - 1 || j == 0 || j == cols - 1;
+
+            game->board[i][j * 2] = corner ? ' ' :
+                    edge ? '0' : '1' + rand_r(&seed) % 9;
+            game->board[i][j * 2 + 1] = corner ? ' ' : '.';
+        }
+    }
+
+    // Always leave at least one interior tile open.
+    int interior = (rows - 2) * (cols - 2);
+    int taken = interior * fill / 100;
+    if (taken >= interior) {
+        taken = interior - 1;
+    }
+    while (taken > 0) {
+        int row = 1 + rand_r(&seed) % (rows - 2);
+        int col = 1 + rand_r(&seed) % (cols - 2);
+        if (*get_pos(game, row, col) == '.') {
+            *get_pos(game, row, col) = (taken % 2) ? 'O' : 'X';
+            taken--;
+        }
+    }
+    return game;
+}
+
+/**
+ * Copies one board into another.
+ * @param game The game holding the board dimensions.
+ * @param to The board to copy into.
+ * @param from The board to copy from.
+ */
+void copy_board(struct Game* game, char** to, char** from) {
+    for (int i = 0; i < *game->rows; ++i) {
+        memcpy(to[i], from[i], *game->cols * 2);
+    }
+}
+
+/**
+ * Takes a copy of the current game board to restore between samples.
+ * @param bench The bench information.
+ */
+void save_template(struct Bench* bench) {
+    copy_board(bench->game, bench->template, bench->game->board);
+}
+
+/**
+ * Finds the open interior tile closest to the centre of the board.
+ * @param game The game information.
+ * @param row The row of the tile found.
+ * @param col The column of the tile found.
+ */
+void open_tile(struct Game* game, int* row, int* col) {
+    for (int i = 1; i < *game->rows - 1; ++i) {
+        int r = (*game->rows / 2 + i) % (*game->rows - 2) + 1;
+        for (int j = 1; j < *game->cols - 1; ++j) {
+            int c = (*game->cols / 2 + j) % (*game->cols - 2) + 1;
+            if (*get_pos(game, r, c) == '.') {
+                *row = r;
+                *col = c;
+                return;
+            }
+        }
+    }
+}
+
+/**
+ * Times a move played through the normal move handling.
+ * @param game The game information.
+ * @param row The row to play.
+ * @param col The column to play.
+ */
+void op_play_move(struct Game* game, int row, int col) {
+    play_move(game, row, col);
+}
+
+/**
+ * Times a vertical shift from the top or bottom edge.
+ * @param game The game information.
+ * @param row The row to play.
+ * @param col The column to play.
+ */
+void op_vert_shift(struct Game* game, int row, int col) {
+    handle_vert_shift(game, row, col, row != 0);
+}
+
+/**
+ * Times a horizontal shift from the left or right edge.
+ * @param game The game information.
+ * @param row The row to play.
+ * @param col The column to play.
+ */
+void op_hori_shift(struct Game* game, int row, int col) {
+    handle_hori_shift(game, row, col, col != 0);
+}
+
+/**
+ * Times the full board check.
+ * @param game The game information.
+ * @param row The row to play.
+ * @param col The column to play.
+ */
+void op_full_board(struct Game* game, int row, int col) {
+    full_board(game);
+}
+
+/**
+ * Times the scoring of the board.
+ * @param game The game information.
+ * @param row The row to play.
+ * @param col The column to play.
+ */
+void op_get_score(struct Game* game, int row, int col) {
+    game->score[0] = 0;
+    game->score[1] = 0;
+    get_score(game);
+}
+
+/**
+ * Times a single decision of the type zero automated player.
+ * @param game The game information.
+ * @param row The row to play.
+ * @param col The column to play.
+ */
+void op_auto_zero(struct Game* game, int row, int col) {
+    play_auto_zero(game, false);
+}
+
+/**
+ * Times a single decision of the type one automated player.
+ * @param game The game information.
+ * @param row The row to play.
+ * @param col The column to play.
+ */
+void op_auto_one(struct Game* game, int row, int col) {
+    play_auto_one(game);
+}
+
+/**
+ * Times an operation against the saved template board. The board
+ * is restored before every sample and outside the timed region.
+ * @param bench The bench information.
+ * @param name The name of the operation.
+ * @param op The operation to time.
+ * @param row The row given to the operation.
+ * @param col The column given to the operation.
+ * @param fill The fill percentage of the board.
+ */
+void run_op(struct Bench* bench, const char* name, Op op,
+        int row, int col, int fill) {
+    struct Game* game = bench->game;
+    double total = 0;
+
+    for (int i = -WARMUP_SAMPLES; i < bench->samples; ++i) {
+        copy_board(game, game->board, bench->template);
+        game->curTurn = 'O';
+
+        long start = now_ns();
+        op(game, row, col);
+        long elapsed = now_ns() - start;
+
+        if (i >= 0) {
+            bench->times[i] = elapsed;
+            total += elapsed;
+        }
+    }
+    qsort(bench->times, bench->samples, sizeof(long), compare_times);
+
+    struct Result* result = &bench->results[bench->numResults++];
+    result->op = name;
+    result->rows = *game->rows;
+    result->cols = *game->cols;
+    result->fill = fill;
+    result->samples = bench->samples;
+    result->mean = total / bench->samples;
+    result->p50 = bench->times[bench->samples / 2];
+    result->p99 = bench->times[(bench->samples * 99) / 100];
+}
+
+/**
+ * Times an edge move after making the edge playable by taking the
+ * tile next to it.
+ * @param bench The bench information.
+ * @param name The name of the operation.
+ * @param op The operation to time.
+ * @param row The edge row to play.
+ * @param col The edge column to play.
+ * @param fill The fill percentage of the board.
+ */
+void run_edge_op(struct Bench* bench, const char* name, Op op,
+        int row, int col, int fill) {
+    struct Game* game = bench->game;
+    int inRow = row == 0 ? 1 : row == *game->rows - 1 ? row - 1 : row;
+    int inCol = col == 0 ? 1 : col == *game->cols - 1 ? col - 1 : col;
+
+    copy_board(game, game->board, bench->template);
+    *get_pos(game, inRow, inCol) = 'X';
+    save_template(bench);
+    run_op(bench, name, op, row, col, fill);
+}
+
+/**
+ * Runs every operation against a single generated board.
+ * @param bench The bench information.
+ * @param size The number of rows and columns in the board.
+ * @param fill The fill percentage of the board.
+ */
+void run_board(struct Bench* bench, int size, int fill) {
+    struct Game* game = generate_game(size, size, fill, size * 101 + fill);
+    int row = 1;
+    int col = 1;
+    int mid = size / 2;
+
+    bench->game = game;
+    bench->template = malloc(sizeof(char*) * size);
+    for (int i = 0; i < size; ++i) {
+        bench->template[i] = malloc(sizeof(char) * size * 2);
+    }
+    save_template(bench);
+    open_tile(game, &row, &col);
+
+    run_op(bench, "play_move_interior", op_play_move, row, col, fill);
+    run_op(bench, "full_board", op_full_board, 0, 0, fill);
+    run_op(bench, "get_score", op_get_score, 0, 0, fill);
+    run_op(bench, "auto_zero", op_auto_zero, 0, 0, fill);
+    run_op(bench, "auto_one", op_auto_one, 0, 0, fill);
+
+    run_edge_op(bench, "play_move_top", op_play_move, 0, mid, fill);
+    run_edge_op(bench, "play_move_left", op_play_move, mid, 0, fill);
+    run_edge_op(bench, "play_move_bottom", op_play_move,
+            size - 1, mid, fill);
+    run_edge_op(bench, "play_move_right", op_play_move,
+            mid, size - 1, fill);
+    run_edge_op(bench, "handle_vert_shift", op_vert_shift, 0, mid, fill);
+    run_edge_op(bench, "handle_hori_shift", op_hori_shift, mid, 0, fill);
+
+    for (int i = 0; i < size; ++i) {
+        free(game->board[i]);
+        free(bench->template[i]);
+    }
+    free(game->board);
+    free(bench->template);
+    free(game->rows);
+    free(game->cols);
+    free(game);
+}
+
+/**
+ * Prints the results as a table.
+ * @param bench The bench information.
+ * @param output The file stream to output to.
+ */
+void print_table(struct Bench* bench, FILE* output) {
+    fprintf(output, "%-20s %7s %5s %10s %8s %8s\n",
+            "op", "board", "fill", "ns/op", "p50", "p99");
+    for (int i = 0; i < bench->numResults; ++i) {
+        struct Result* r = &bench->results[i];
+        fprintf(output, "%-20s %3dx%-3d %4d%% %10.1f %8ld %8ld\n",
+                r->op, r->rows, r->cols, r->fill, r->mean, r->p50, r->p99);
+    }
+    fflush(output);
+}
+
+/**
+ * Prints the results as a JSON document.
+ * @param bench The bench information.
+ * @param output The file stream to output to.
+ */
+void print_json(struct Bench* bench, FILE* output) {
+    fprintf(output, "{\n  \"samples\": %d,\n  \"results\": [\n",
+            bench->samples);
+    for (int i = 0; i < bench->numResults; ++i) {
+        struct Result* r = &bench->results[i];
+        fprintf(output, "    {\"op\": \"%s\", \"rows\": %d, \"cols\": %d, "
+                "\"fill\": %d, \"ns_per_op\": %.1f, \"p50_ns\": %ld, "
+                "\"p99_ns\": %ld}%s\n", r->op, r->rows, r->cols, r->fill,
+                r->mean, r->p50, r->p99,
+                (i < bench->numResults - 1) ? "," : "");
+    }
+    fprintf(output, "  ]\n}\n");
+    fflush(output);
+}
+
+/**
+ * Runs the benchmarks over each board size and fill ratio.
+ * @param argc The number of parameters.
+ * @param argv The input parameters.
+ * @return Zero if the benchmarks completed.
+ */
+int main(int argc, char** argv) {
+    int sizes[] = {5, 10, 20, 40};
+    int fills[] = {0, 50, 90};
+    struct Bench bench;
+
+    if (argc > 3) {
+        fprintf(stderr, "Usage: bench2310 [samples [jsonfile]]\n");
+        return 1;
+    }
+
+    bench.samples = (argc > 1) ? atoi(argv[1]) : DEFAULT_SAMPLES;
+    if (bench.samples < 1) {
+        fprintf(stderr, "Invalid sample count\n");
+        return 2;
+    }
+    bench.times = malloc(sizeof(long) * bench.samples);
+    bench.results = malloc(sizeof(struct Result) * 4 * 3 * 11);
+    bench.numResults = 0;
+
+    // The automated players report their moves on stdout.
+    FILE* report = fdopen(dup(STDOUT_FILENO), "w");
+    if (report == NULL || freopen("/dev/null", "w", stdout) == NULL) {
+        fprintf(stderr, "Unable to redirect output\n");
+        return 3;
+    }
+
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            run_board(&bench, sizes[i], fills[j]);
+        }
+    }
+    print_table(&bench, report);
+
+    if (argc > 2) {
+        FILE* json = fopen(argv[2], "w");
+        if (json == NULL) {
+            fprintf(stderr, "Unable to write results\n");
+            return 3;
+        }
+        print_json(&bench, json);
+        fclose(json);
+    }
+    return 0;
+}
@@ -1,21 +1,4 @@
-#include <stdbool.h>
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-#include <ctype.h>
-
-struct Game {
-    char player1;
-    char player2;
-    char* saveFileName;
-    int* rows;
-    int* cols;
-    char curTurn;
-    char** board;
-    int score[2];
-    int oneRow;
-    int oneCol;
-};
+#include "main.h"
 
 /**
  * Determines whether a player type is correct.
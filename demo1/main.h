@@ -0,0 +1,39 @@
+#ifndef ASS1_MAIN_H
+#define ASS1_MAIN_H
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+struct Game {
+    char player1;
+    char player2;
+    char* saveFileName;
+    int* rows;
+    int* cols;
+    char curTurn;
+    char** board;
+    int score[2];
+    int oneRow;
+    int oneCol;
+};
+
+bool full_board(struct Game* game);
+
+char* get_pos(struct Game* game, int row, int col);
+
+bool handle_vert_shift(struct Game* game, int row, int col, bool reverse);
+
+bool handle_hori_shift(struct Game* game, int row, int col, bool reverse);
+
+bool play_move(struct Game* game, int row, int col);
+
+void get_score(struct Game* game);
+
+void play_auto_zero(struct Game* game, bool reverse);
+
+void play_auto_one(struct Game* game);
+
+#endif //ASS1_MAIN_H
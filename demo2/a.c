@@ -17,10 +17,8 @@ void play_move(Game* game, Player* player) {
     }
 
     // #2 case in user move choice.
-    Stop* nextStop = get_stop(game->board, player, 0);
-    nextStop++;
-    if (valid_money_stop(nextStop)) {
-        chosen_move(position(game->board, 0, "Mo"), stdout);
+    if (valid_money_stop(&game->board->stops[curStop + 1])) {
+        chosen_move(curStop + 1, stdout);
         return;
     }
 
@@ -31,24 +29,23 @@ void play_move(Game* game, Player* player) {
 }
 
 /**
- * Searches for a money conversion stop to move the player to.
+ * Searches for a money conversion stop before the next barrier to move
+ * the player to.
  * @param game The game information.
  * @param curStop The current stop of the player.
  * @param player The player to search for.
  * @return True if the player has chosen this stop.
  */
 bool search_money(Game* game, int curStop, Player* player) {
-    for (int i = curStop; i < game->board->numStops; ++i) {
-        Stop* stop = &game->board->stops[i];
-        if (strcmp(stop->type, "Do") == 0) {
-            if (at_capacity(stop)) {
-                return false;
-            }
-            chosen_move(position(game->board, curStop, "Do"), stdout);
-            return true;
-        }
+    Board* board = game->board;
+    int pos = board->next[STOP_DO][curStop + 1];
+
+    if (pos > board->next[STOP_BARRIER][curStop + 1] ||
+            at_capacity(&board->stops[pos])) {
+        return false;
     }
-    return false;
+    chosen_move(pos, stdout);
+    return true;
 }
 
 /**
@@ -58,18 +55,14 @@ bool search_money(Game* game, int curStop, Player* player) {
  * @return True if a suitable stop has been chosen.
  */
 bool search_v(Game* game, int curStop) {
-    for (int i = curStop + 1; i < game->board->numStops; ++i) {
-        Stop* stop = &game->board->stops[i];
-        if (strcmp(stop->type, "V1") == 0 && !at_capacity(stop)) {
-            chosen_move(position(game->board, curStop + 1, "V1"), stdout);
-            return true;
-        } else if (strcmp(stop->type, "V2") == 0 && !at_capacity(stop)) {
-            chosen_move(position(game->board, curStop + 1, "V2"), stdout);
-            return true;
-        } else if (strcmp(stop->type, "::") == 0 && !at_capacity(stop)) {
-            chosen_move(position(game->board, curStop + 1, "::"), stdout);
-            return true;
-        }
+    int kinds = KIND_BIT(STOP_V1) | KIND_BIT(STOP_V2) |
+            KIND_BIT(STOP_BARRIER);
+    int pos = next_open(game->board, kinds, curStop + 1,
+            game->board->numStops);
+
+    if (pos < 0) {
+        return false;
     }
-    return false;
+    chosen_move(pos, stdout);
+    return true;
 }
\ No newline at end of file
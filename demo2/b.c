@@ -2,7 +2,7 @@
 
 bool others_later(Board* board, Player* player, int curStop);
 void first_open(Board* board, int curStop);
-bool look_for(Board* board, int curStop, bool (*check)(Stop*));
+bool look_for(Board* board, int curStop, Kind kind);
 int next_barrier(Board* board, int curStop);
 bool highest_card(Board* board, Player* player, int curStop);
 
@@ -21,7 +21,7 @@ void play_move(Game* game, Player* player) {
     }
     // #2 case in user move choice.
     if (player->money % 2 != 0 &&
-            look_for(game->board, curStop, &valid_money_stop)) {
+            look_for(game->board, curStop, STOP_MO)) {
         //printf(" %d", player->money % 2);
         //printf("B\n");
         return;
@@ -34,7 +34,7 @@ void play_move(Game* game, Player* player) {
     }
 
     // #4 case in user move choice.
-    if (look_for(game->board, curStop, &valid_v2_stop)) {
+    if (look_for(game->board, curStop, STOP_V2)) {
         //printf("D\n");
         return;
     }
@@ -53,17 +53,12 @@ void play_move(Game* game, Player* player) {
  *          player has been moved.
  */
 bool others_later(Board* board, Player* player, int curStop) {
-    if (get_stop(board, player, curStop)->numPlaced > 1) {
+    // The rearmost occupied stop is never behind the player.
+    if (get_stop(board, player, curStop)->numPlaced > 1 ||
+            board->rear != curStop) {
         return false;
     }
 
-    for (int i = 0; i < curStop; ++i) {
-        Stop* stop = &board->stops[i];
-        if (stop->numPlaced > 0) {
-            return false;
-        }
-    }
-
     if (at_capacity(&board->stops[curStop + 1])) {
         return false;
     }
@@ -72,23 +67,22 @@ bool others_later(Board* board, Player* player, int curStop) {
 }
 
 /**
- * A function that looks for a stop to move the player from
- * input criteria.
+ * A function that looks for an open stop of a kind before the next
+ * barrier to move the player to.
  * @param board The board to search.
  * @param curStop The current stop of the player.
- * @param check The function pointer to the check criteria.
+ * @param kind The kind of stop to look for.
  * @return True if the player has been moved.
  */
-bool look_for(Board* board, int curStop, bool (*check)(Stop*)) {
-    int nextBarr = next_barrier(board, curStop);
-    for (int i = curStop + 1; i < nextBarr; ++i) {
-        Stop* stop = &board->stops[i];
-        if (check(stop)) {
-            chosen_move(i, stdout);
-            return true;
-        }
+bool look_for(Board* board, int curStop, Kind kind) {
+    int pos = next_open(board, KIND_BIT(kind), curStop + 1,
+            next_barrier(board, curStop));
+
+    if (pos < 0) {
+        return false;
     }
-    return false;
+    chosen_move(pos, stdout);
+    return true;
 }
 
 /**
@@ -97,12 +91,10 @@ bool look_for(Board* board, int curStop, bool (*check)(Stop*)) {
  * @param curStop The current stop of the player.
  */
 void first_open(Board* board, int curStop) {
-    for (int i = curStop + 1; i < board->numStops; ++i) {
-        Stop* stop = &board->stops[i];
-        if (!at_capacity(stop)) {
-            chosen_move(i, stdout);
-            return;
-        }
+    int pos = next_open(board, ANY_KIND, curStop + 1, board->numStops);
+
+    if (pos >= 0) {
+        chosen_move(pos, stdout);
     }
 }
 
@@ -113,13 +105,7 @@ void first_open(Board* board, int curStop) {
  * @return The position of the next barrier on the board.
  */
 int next_barrier(Board* board, int curStop) {
-    for (int i = curStop + 1; i < board->numStops; ++i) {
-        Stop* stop = &board->stops[i];
-        if (strcmp(stop->type, "::") == 0) {
-            return i;
-        }
-    }
-    return 0;
+    return position(board, curStop + 1, STOP_BARRIER);
 }
 
 /**
@@ -131,16 +117,13 @@ int next_barrier(Board* board, int curStop) {
  *          and has been moved.
  */
 bool highest_card(Board* board, Player* player, int curStop) {
-    for (int i = 0; i < board->numStops; ++i) {
-        Stop* stop = &board->stops[i];
-        for (int j = 0; j < stop->numPlaced; ++j) {
-            if (stop->placed[j].numCards > player->numCards) {
-                return false;
-            }
+    for (int i = 0; i < board->numPlayers; ++i) {
+        if (get_player(board, i)->numCards > player->numCards) {
+            return false;
         }
     }
 
-    if (look_for(board, curStop, &valid_ri_stop)) {
+    if (look_for(board, curStop, STOP_RI)) {
         return true;
     }
     return false;
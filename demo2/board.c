@@ -1,45 +1,55 @@
 #include "board.h"
 
-int contains(Stop* stop, pid_t pid);
+const char* kindNames[NUM_KINDS] = {"Mo", "Do", "V1", "V2", "Ri", "::"};
+
+int contains(Board* board, Stop* stop, pid_t pid);
 bool add_card(Player* player, int card);
 int count_cards(Player* player, int card);
-int lowest_card(int* cards);
 int value_cards(Player* player);
-bool add_player(Stop* stop, Player* player);
-bool remove_player(Stop* stop, Player* player);
-Player* move(Stop* from, Stop* to, Player* player);
+void update_open(Board* board, Stop* stop);
+bool add_player(Board* board, Stop* stop, Player* player);
+bool remove_player(Board* board, Stop* stop, Player* player);
+Player* move(Board* board, Stop* from, Stop* to, Player* player);
 int highest_placed(Board* board);
+int column_width(Board* board);
+bool intern_kind(Stop* stop);
 bool add_stops(Board* board, char* path);
+void add_skips(Board* board);
+void add_open(Board* board);
+int next_open(Board* board, int kinds, int from, int limit);
 void add_players(Board* board);
 bool read_path(Board* board, FILE* file);
 void print_board(Board* board, FILE* output);
 void print_player(Player* player, FILE* output);
 Player* get_player(Board* board, pid_t pid);
 Stop* get_stop(Board* board, Player* player, int pos);
-int position(Board* board, int start, char* type);
-int distance(Board* board, Player* player, char* type);
+int position(Board* board, int start, Kind kind);
+int distance(Board* board, Player* player, Kind kind);
 void chosen_move(int distance, FILE* output);
 bool at_capacity(Stop* stop);
 int score(Player* player);
 void output_scores(Board* board, FILE* output);
 int player_pos(Board* board, Player* player);
 bool valid_money_stop(Stop* stop);
-bool valid_v2_stop(Stop* stop);
-bool valid_ri_stop(Stop* stop);
+Player* next_player(Board* board);
+bool game_over(Board* board);
+bool legal_move(Board* board, Player* player, int to);
+void stop_effects(Board* board, Player* player, int to, int* effects);
+Player* apply_move(Board* board, Player* player, int to, int* effects);
 
 /**
  * Determines whether a player is placed at a certain stop.
+ * @param board The board holding the player locations.
  * @param stop The Stop struct to search for player.
  * @param pid The player id check at the given stop.
  * @return The position of the player at the stop.
  */
-int contains(Stop* stop, pid_t pid) {
-    for (int i = 0; i < stop->numPlaced; ++i) {
-        if (stop->placed[i].pid == pid) {
-            return i;
-        }
+int contains(Board* board, Stop* stop, pid_t pid) {
+    if (pid < 0 || pid >= board->numPlayers ||
+            board->location[pid] != stop - board->stops) {
+        return -1;
     }
-    return -1;
+    return board->slot[pid];
 }
 
 /**
@@ -51,12 +61,10 @@ int contains(Stop* stop, pid_t pid) {
 bool add_card(Player* player, int card) {
     if (card == 0) {
         return true;
-    } else if (card > 5) {
+    } else if (card < 0 || card > NUM_CARDS) {
         return false;
     }
-    player->cards = realloc(player->cards, sizeof(int)
-            * (player->numCards + 1));
-    player->cards[player->numCards] = card;
+    player->cards[card - 1]++;
     player->numCards++;
     return true;
 }
@@ -68,101 +76,102 @@ bool add_card(Player* player, int card) {
  * @return The number of that type of cards the player has.
  */
 int count_cards(Player* player, int card) {
-    int counter = 0;
-    for (int i = 0; i < player->numCards; ++i) {
-        if (player->cards[i] == card) {
-            counter++;
-        }
-    }
-    return counter;
-}
-
-/**
- * Searches for the lowest number of a single type of card.
- * @param cards The type of card to search for.
- * @return The position of the lowest type of card.
- */
-int lowest_card(int* cards) {
-    int low = INT_MAX;
-    int pos = 5;
-
-    for (int i = 0; i < 5; ++i) {
-        if (cards[i] < low && cards[i] > 0) {
-            low = cards[i];
-            pos = i;
-        }
-    }
-    return pos;
+    return player->cards[card - 1];
 }
 
 /**
  * Calculates the point value of all the cards a player has in their
- * card inventory.
+ * card inventory. Sets are made from one of each type the player still
+ * has, so with the counts sorted from most to least, the number of sets
+ * of size k is the difference between the k-th and (k+1)-th counts.
  * @param player The player struct information to search for cards.
  * @return The value of all the cards that the player has.
  */
 int value_cards(Player* player) {
-    int cardVals[5] = {1, 3, 5, 7, 10};
-    int cards[5];
+    int cardVals[NUM_CARDS] = {1, 3, 5, 7, 10};
+    int cards[NUM_CARDS + 1];
     int score = 0;
 
-    for (int i = 0; i < 5; ++i) {
-        cards[i] = count_cards(player, i + 1);
-    }
-
-    while (true) {
-        int lowCount = lowest_card(cards);
-        if (lowCount == 5) {
-            break;
+    for (int i = 0; i < NUM_CARDS; ++i) {
+        int count = player->cards[i];
+        int j = i;
+        for (; j > 0 && cards[j - 1] < count; --j) {
+            cards[j] = cards[j - 1];
         }
+        cards[j] = count;
+    }
+    cards[NUM_CARDS] = 0;
 
-        int count = 0;
-        for (int i = 0; i < 5; ++i) {
-            if (cards[i] > 0) {
-                cards[i]--;
-                count++;
-            }
-        }
-        score += cardVals[count - 1];
+    for (int k = 0; k < NUM_CARDS; ++k) {
+        score += (cards[k] - cards[k + 1]) * cardVals[k];
     }
     return score;
 }
 
+/**
+ * Updates the free capacity bitmaps for a stop after a player has been
+ * added to or removed from it.
+ * @param board The board holding the bitmaps.
+ * @param stop The stop that changed.
+ */
+void update_open(Board* board, Stop* stop) {
+    int pos = stop - board->stops;
+    uint64_t bit = 1ULL << (pos % 64);
+
+    if (at_capacity(stop)) {
+        board->open[pos / 64] &= ~bit;
+        board->openKind[stop->kind][pos / 64] &= ~bit;
+    } else {
+        board->open[pos / 64] |= bit;
+        board->openKind[stop->kind][pos / 64] |= bit;
+    }
+}
+
 /**
  * Adds a player to a stop.
+ * @param board The board holding the player locations.
  * @param stop The Stop struct to add the player to.
  * @param player The Player to be added to the struct.
  * @return True if the player was successfully added to the stop.
  */
-bool add_player(Stop* stop, Player* player) {
+bool add_player(Board* board, Stop* stop, Player* player) {
     if (stop->cap == stop->numPlaced) {
         return false;
     }
 
-    if (stop->numPlaced < 1) {
-        stop->placed[0] = *player;
-    } else {
-        stop->placed[stop->numPlaced] = *player;
+    // Stops only grow their list of players as it fills.
+    if (stop->numPlaced == stop->size) {
+        stop->size = (stop->size > 0) ? stop->size * 2 : 4;
+        stop->placed = realloc(stop->placed, sizeof(int) * stop->size);
     }
 
+    stop->placed[stop->numPlaced] = player->pid;
+    board->location[player->pid] = stop - board->stops;
+    board->slot[player->pid] = stop->numPlaced;
+
     stop->numPlaced += 1;
+    update_open(board, stop);
     return true;
 }
 
 /**
- * Removes a Player from a given Stop.
+ * Removes a Player from a given Stop. The players that arrived after it
+ * shuffle down a slot.
+ * @param board The board holding the player locations.
  * @param stop The stop to remove the player from.
  * @param player The player to be removed.
  * @return True if the player was successfully removed from the stop.
  */
-bool remove_player(Stop* stop, Player* player) {
-    int pos = contains(stop, player->pid);
+bool remove_player(Board* board, Stop* stop, Player* player) {
+    int pos = contains(board, stop, player->pid);
 
     if (pos >= 0) {
         for (int i = pos; i < stop->numPlaced - 1; ++i) {
             stop->placed[i] = stop->placed[i + 1];
+            board->slot[stop->placed[i]] = i;
         }
         stop->numPlaced--;
+        update_open(board, stop);
         return true;
     }
 
@@ -170,20 +179,31 @@ bool remove_player(Stop* stop, Player* player) {
 }
 
 /**
- * Moved a player from one stop to another.
+ * Moved a player from one stop to another. Keeps track of the rearmost
+ * occupied stop, which only ever moves forward as players do.
+ * @param board The board that the stops are on.
  * @param from The stop that the player currently sits.
  * @param to The stop to move the player to.
  * @param player The player to be mvoed.
- * @return True if the player has been moved.
+ * @return The player that was moved, or NULL if they were not moved.
  */
-Player* move(Stop* from, Stop* to, Player* player) {
-    if (strcmp(to->type, "V1") == 0) {
+Player* move(Board* board, Stop* from, Stop* to, Player* player) {
+    if (at_capacity(to) || !remove_player(board, from, player)) {
+        return NULL;
+    }
+
+    if (to->kind == STOP_V1) {
         player->visited[0] += 1;
-    } else if (strcmp(to->type, "V2") == 0) {
+    } else if (to->kind == STOP_V2) {
         player->visited[1] += 1;
     }
-    return (add_player(to, player) &&
-            remove_player(from, player)) ? player : NULL;
+    add_player(board, to, player);
+
+    while (board->rear < board->numStops - 1 &&
+            board->stops[board->rear].numPlaced == 0) {
+        board->rear++;
+    }
+    return player;
 }
 
 /**
@@ -203,6 +223,21 @@ int highest_placed(Board* board) {
     return high;
 }
 
+/**
+ * Converts the two character type of a stop into its kind.
+ * @param stop The stop to set the kind of.
+ * @return True if the stop has a known type.
+ */
+bool intern_kind(Stop* stop) {
+    for (int k = 0; k < NUM_KINDS; ++k) {
+        if (strcmp(stop->type, kindNames[k]) == 0) {
+            stop->kind = k;
+            return true;
+        }
+    }
+    return false;
+}
+
 /**
  * Adds and initialises stops for the board.
  * @param board The board struct information.
@@ -214,18 +249,23 @@ bool add_stops(Board* board, char* path) {
     for (int i = 0; i < board->numStops * 3; i += 3) {
         Stop* stop = malloc(sizeof(Stop));
         strncpy(stop->type, path + i, 2);
+        stop->type[2] = '\0';
+        if (!intern_kind(stop)) {
+            return false;
+        }
+        stop->isBarrier = stop->kind == STOP_BARRIER;
         char* cap = path + i + 2;
 
         if (isdigit(*cap)) {
             stop->cap = atoi(cap);
         } else if (*cap == '-') {
             stop->cap = board->numPlayers;
-            stop->isBarrier = true;
         } else {
             return false;
         }
 
-        stop->placed = malloc(sizeof(Player) * board->numPlayers);
+        stop->placed = NULL;
+        stop->size = 0;
         stop->numPlaced = 0;
 
         board->stops[i / 3] = *stop;
@@ -234,19 +274,99 @@ bool add_stops(Board* board, char* path) {
 }
 
 /**
- * Adds starting players to the board.
+ * Builds the skip tables that give the position of the next stop of
+ * each kind at or after any position on the board. Positions with no
+ * later stop of a kind hold the number of stops.
+ * @param board The board to build the tables for.
+ */
+void add_skips(Board* board) {
+    for (int k = 0; k < NUM_KINDS; ++k) {
+        board->next[k] = malloc(sizeof(int) * (board->numStops + 1));
+        board->next[k][board->numStops] = board->numStops;
+    }
+
+    for (int i = board->numStops - 1; i >= 0; --i) {
+        for (int k = 0; k < NUM_KINDS; ++k) {
+            board->next[k][i] = (board->stops[i].kind == k) ?
+                    i : board->next[k][i + 1];
+        }
+    }
+}
+
+/**
+ * Builds the bitmaps of stops that have free capacity, one for all stops
+ * and one for each kind of stop.
+ * @param board The board to build the bitmaps for.
+ */
+void add_open(Board* board) {
+    board->numWords = (board->numStops + 63) / 64;
+    board->open = calloc(board->numWords, sizeof(uint64_t));
+    for (int k = 0; k < NUM_KINDS; ++k) {
+        board->openKind[k] = calloc(board->numWords, sizeof(uint64_t));
+    }
+
+    for (int i = 0; i < board->numStops; ++i) {
+        update_open(board, &board->stops[i]);
+    }
+}
+
+/**
+ * Finds the first stop with free capacity in a range of the board,
+ * scanning a word of the bitmaps at a time.
+ * @param board The board to search.
+ * @param kinds The bits of the kinds of stop to look for, or ANY_KIND.
+ * @param from The first position to search.
+ * @param limit The position to stop searching before.
+ * @return The position of the open stop, or -1 if there is none.
+ */
+int next_open(Board* board, int kinds, int from, int limit) {
+    if (from >= limit) {
+        return -1;
+    }
+
+    int word = from / 64;
+    uint64_t mask = ~0ULL << (from % 64);
+    for (; word <= (limit - 1) / 64; ++word) {
+        uint64_t bits = 0;
+        if (kinds == ANY_KIND) {
+            bits = board->open[word];
+        } else {
+            for (int k = 0; k < NUM_KINDS; ++k) {
+                if (kinds & KIND_BIT(k)) {
+                    bits |= board->openKind[k][word];
+                }
+            }
+        }
+
+        bits &= mask;
+        if (bits != 0) {
+            int pos = word * 64 + __builtin_ctzll(bits);
+            return (pos < limit) ? pos : -1;
+        }
+        mask = ~0ULL;
+    }
+    return -1;
+}
+
+/**
+ * Adds starting players to the board. The board owns every player and
+ * stops only refer to them by id.
  * @param board The board to add the starting players to.
  */
 void add_players(Board* board) {
+    board->players = calloc(board->numPlayers, sizeof(Player));
+    board->location = calloc(board->numPlayers, sizeof(int));
+    board->slot = calloc(board->numPlayers, sizeof(int));
     for (int j = board->numPlayers - 1; j >= 0; --j) {
-        Player* newPlayer = malloc(sizeof(Player));
+        Player* newPlayer = &board->players[j];
         newPlayer->pid = j;
         newPlayer->money = 7;
         newPlayer->points = 0;
         newPlayer->visited[0] = 0;
         newPlayer->visited[1] = 0;
-        add_player(&board->stops[0], newPlayer);
+        add_player(board, &board->stops[0], newPlayer);
     }
+    board->rear = 0;
 }
 
 /**
@@ -283,39 +403,58 @@ bool read_path(Board* board, FILE* file) {
         return false;
     }
 
-    if (strcmp(board->stops[0].type, "::") != 0 ||
-            strcmp(board->stops[board->numStops - 1].type, "::") != 0) {
+    if (board->stops[0].kind != STOP_BARRIER ||
+            board->stops[board->numStops - 1].kind != STOP_BARRIER) {
         return false;
     }
 
+    add_skips(board);
+    add_open(board);
     add_players(board);
     return true;
 }
 
+/**
+ * Determines the width of each stop's column when printing the board,
+ * which must fit the largest player id and a space.
+ * @param board The board information.
+ * @return The width of a column.
+ */
+int column_width(Board* board) {
+    int width = 2;
+    for (int pid = board->numPlayers - 1; pid >= 10; pid /= 10) {
+        width++;
+    }
+    return (width < 3) ? 3 : width;
+}
+
 /**
  * Prints the current status of the board.
  * @param board The board information.
  * @param file The file stream to output to.
  */
 void print_board(Board* board, FILE* output) {
+    int width = column_width(board);
     for (int j = 0; j < board->numStops; ++j) {
         Stop* stop = &board->stops[j];
-        fprintf(output, "%s ", stop->type);
+        fprintf(output, "%-*s", width, stop->type);
     }
     fprintf(output, "\n");
 
     int mostPlaced = highest_placed(board);
 
-    char** location = calloc(board->numPlayers, sizeof(char*));
-    for (int i = 0; i < board->numPlayers; ++i) {
-        location[i] = calloc(board->numStops * 3, sizeof(char));
-        memset(location[i], ' ', board->numStops * 3 - 1);
+    char** location = calloc(mostPlaced, sizeof(char*));
+    for (int i = 0; i < mostPlaced; ++i) {
+        location[i] = calloc(board->numStops * width, sizeof(char));
+        memset(location[i], ' ', board->numStops * width - 1);
     }
 
+    char id[12];
     for (int k = 0; k < board->numStops; ++k) {
         Stop* stop = &board->stops[k];
         for (int i = 0; i < stop->numPlaced; ++i) {
-            location[i][k * 3] = stop->placed[i].pid + '0';
+            int length = sprintf(id, "%d", stop->placed[i]);
+            memcpy(&location[i][k * width], id, length);
         }
     }
 
@@ -330,11 +469,7 @@ void print_board(Board* board, FILE* output) {
  * @param output The file stream to output the information to.
  */
 void print_player(Player* player, FILE* output) {
-    int cards[5];
-    for (int i = 1; i < 6; ++i) {
-        cards[i - 1] = count_cards(player, i);
-    }
-
+    int* cards = player->cards;
     fprintf(output, "Player %d Money=%d V1=%d V2=%d "
             "Points=%d A=%d B=%d C=%d D=%d E=%d\n",
             player->pid, player->money, player->visited[0], player->visited[1],
@@ -348,15 +483,10 @@ void print_player(Player* player, FILE* output) {
  * @return The pointer to the location of the Player.
  */
 Player* get_player(Board* board, pid_t pid) {
-    for (int i = 0; i < board->numStops; ++i) {
-        Stop* stop = &board->stops[i];
-        for (int j = 0; j < stop->numPlaced; ++j) {
-            if (stop->placed[j].pid == pid) {
-                return &stop->placed[j];
-            }
-        }
+    if (pid < 0 || pid >= board->numPlayers) {
+        return NULL;
     }
-    return NULL;
+    return &board->players[pid];
 }
 
 /**
@@ -367,43 +497,32 @@ Player* get_player(Board* board, pid_t pid) {
  * @return The location of the stop information on the board.
  */
 Stop* get_stop(Board* board, Player* player, int pos) {
-    for (int i = pos; i < board->numStops; ++i) {
-        Stop* stop = &board->stops[i];
-        for (int j = 0; j < stop->numPlaced; ++j) {
-            if (stop->placed[j].pid == player->pid) {
-                return stop;
-            }
-        }
-    }
-    return NULL;
+    int location = board->location[player->pid];
+    return (location >= pos) ? &board->stops[location] : NULL;
 }
 
 /**
- * The position of a type of stop on the board.
+ * The position of a kind of stop on the board.
  * @param board THe board to search for the position of the stop.
  * @param start The start position of the search.
- * @param type The type of stop to search for.
+ * @param kind The kind of stop to search for.
  * @return The location of the stop on the board.
  */
-int position(Board* board, int start, char* type) {
-    for (int i = start; i < board->numStops; ++i) {
-        if (strcmp(board->stops[i].type, type) == 0) {
-            return i;
-        }
-    }
-    return 0;
+int position(Board* board, int start, Kind kind) {
+    int pos = board->next[kind][start];
+    return (pos < board->numStops) ? pos : 0;
 }
 
 /**
- * Gets the distance between a type of stop and a player.
+ * Gets the distance between a kind of stop and a player.
  * @param board The board to search.
  * @param player The player to search for.
- * @param type The type of stop to get the distance.
+ * @param kind The kind of stop to get the distance.
  * @return The distance from the player to the given stop.
  */
-int distance(Board* board, Player* player, char* type) {
-    return position(board, 0, type) -
-            position(board, 0, get_stop(board, player, 0)->type);
+int distance(Board* board, Player* player, Kind kind) {
+    int pos = player_pos(board, player);
+    return position(board, pos, kind) - pos;
 }
 
 /**
@@ -413,6 +532,7 @@ int distance(Board* board, Player* player, char* type) {
  */
 void chosen_move(int distance, FILE* output) {
     fprintf(output, "DO%d\n", distance);
+    fflush(output);
 }
 
 /**
@@ -439,26 +559,17 @@ int score(Player* player) {
 }
 
 /**
- * Outputs the final scores for all the players.
+ * Outputs the final scores for all the players. Scores are kept up to
+ * date as each move is applied.
  * @param board The board that contains the players.
  * @param output The file stream to output the score to.
  */
 void output_scores(Board* board, FILE* output) {
-    int* scores = calloc(board->numPlayers, sizeof(int));
-    char* line = calloc(256, sizeof(char));
-    char buffer[256];
-    strcat(line, "Scores: ");
-
+    fprintf(output, "Scores: ");
     for (int i = 0; i < board->numPlayers; ++i) {
-        Player* player = get_player(board, i);
-        scores[i] = score(player);
-        sprintf(buffer, "%d", scores[i]);
-        strcat(line, buffer);
-        if (i < board->numPlayers - 1) {
-            strcat(line, ",");
-        }
+        fprintf(output, (i < board->numPlayers - 1) ? "%d," : "%d\n",
+                board->players[i].score);
     }
-    fprintf(output, "%s\n", line);
 }
 
 /**
@@ -468,15 +579,7 @@ void output_scores(Board* board, FILE* output) {
  * @return The position of the player on the board.
  */
 int player_pos(Board* board, Player* player) {
-    for (int i = 0; i < board->numStops; ++i) {
-        Stop* stop = &board->stops[i];
-        for (int j = 0; j < stop->numPlaced; ++j) {
-            if (stop->placed[j].pid == player->pid) {
-                return i;
-            }
-        }
-    }
-    return 0;
+    return board->location[player->pid];
 }
 
 /**
@@ -485,23 +588,102 @@ int player_pos(Board* board, Player* player) {
  * @return True if it is a money stop and space is available.
  */
 bool valid_money_stop(Stop* stop) {
-    return strcmp(stop->type, "Mo") == 0 && !at_capacity(stop);
+    return stop->kind == STOP_MO && !at_capacity(stop);
 }
 
 /**
- * Check used to determine if a stop is a V2 type stop.
- * @param stop The stop to check.
- * @return True if it is a V2 stop and space is available.
+ * Determines which player moves next. This is the player furthest back
+ * on the board, with the most recent arrival at that stop going first.
+ * Players are kept in arrival order, so this is the last player placed
+ * at the rearmost occupied stop.
+ * @param board The board to search.
+ * @return The player who moves next.
  */
-bool valid_v2_stop(Stop* stop) {
-    return strcmp(stop->type, "V2") == 0 && !at_capacity(stop);
+Player* next_player(Board* board) {
+    Stop* stop = &board->stops[board->rear];
+    if (stop->numPlaced == 0) {
+        return NULL;
+    }
+    return &board->players[stop->placed[stop->numPlaced - 1]];
 }
 
 /**
- * Checks used to determine if a stop is a R1 stop.
- * @param stop The stop to check.
- * @return True if it is a R1 stop and space is available.
+ * Determines whether all players have reached the final stop.
+ * @param board The board to check.
+ * @return True if the game has finished.
+ */
+bool game_over(Board* board) {
+    return board->stops[board->numStops - 1].numPlaced == board->numPlayers;
+}
+
+/**
+ * Determines whether a player is allowed to move to a stop. The stop must
+ * be ahead of the player, not past the next barrier and have space.
+ * @param board The board the player is on.
+ * @param player The player that is moving.
+ * @param to The position of the stop to move to.
+ * @return True if the move is allowed.
+ */
+bool legal_move(Board* board, Player* player, int to) {
+    int from = player_pos(board, player);
+    if (to <= from || to >= board->numStops) {
+        return false;
+    }
+    return to <= board->next[STOP_BARRIER][from + 1] &&
+            !at_capacity(&board->stops[to]);
+}
+
+/**
+ * Works out the changes a move makes to a player, drawing from the deck
+ * when the stop gives a card.
+ * @param board The board the player is on.
+ * @param player The player that is moving.
+ * @param to The position of the stop to move to.
+ * @param effects The points, money and card changes for the move.
  */
-bool valid_ri_stop(Stop* stop) {
-    return strcmp(stop->type, "Ri") == 0 && !at_capacity(stop);
+void stop_effects(Board* board, Player* player, int to, int* effects) {
+    Stop* stop = &board->stops[to];
+    effects[0] = 0;
+    effects[1] = 0;
+    effects[2] = 0;
+
+    switch (stop->kind) {
+        case STOP_MO:
+            effects[1] = 3;
+            break;
+        case STOP_DO:
+            effects[0] = player->money / 2;
+            effects[1] = -player->money;
+            break;
+        case STOP_RI:
+            effects[2] = board->cards[board->nextCard];
+            board->nextCard = (board->nextCard + 1) % board->numCards;
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * Applies the changes of a move to a player and moves them on the board.
+ * @param board The board the player is on.
+ * @param player The player that is moving.
+ * @param to The position of the stop to move to.
+ * @param effects The points, money and card changes for the move.
+ * @return The moved player, or NULL if the move could not be applied.
+ */
+Player* apply_move(Board* board, Player* player, int to, int* effects) {
+    player->points += effects[0];
+    player->money += effects[1];
+
+    if (!add_card(player, effects[2])) {
+        return NULL;
+    }
+
+    player = move(board, get_stop(board, player, 0), &board->stops[to],
+            player);
+    if (player != NULL) {
+        player->score = score(player);
+    }
+    return player;
 }
\ No newline at end of file
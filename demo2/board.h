@@ -7,7 +7,7 @@ bool add_card(Player* player, int card);
 
 bool read_path(Board* board, FILE* file);
 
-Player* move(Stop* from, Stop* to, Player* player);
+Player* move(Board* board, Stop* from, Stop* to, Player* player);
 
 void print_board(Board* board, FILE* output);
 
@@ -17,22 +17,30 @@ Player* get_player(Board* board, pid_t pid);
 
 Stop* get_stop(Board* board, Player* player, int pos);
 
-int position(Board* board, int start, char* type);
+int position(Board* board, int start, Kind kind);
 
-int distance(Board* board, Player* player, char* type);
+int distance(Board* board, Player* player, Kind kind);
 
 void chosen_move(int position, FILE* output);
 
 bool at_capacity(Stop* stop);
 
+int next_open(Board* board, int kinds, int from, int limit);
+
 void output_scores(Board* board, FILE* output);
 
 int player_pos(Board* board, Player* player);
 
 bool valid_money_stop(Stop* stop);
 
-bool valid_v2_stop(Stop* stop);
+Player* next_player(Board* board);
+
+bool game_over(Board* board);
+
+bool legal_move(Board* board, Player* player, int to);
+
+void stop_effects(Board* board, Player* player, int to, int* effects);
 
-bool valid_ri_stop(Stop* stop);
+Player* apply_move(Board* board, Player* player, int to, int* effects);
 
 #endif //ASS3_BOARD_H
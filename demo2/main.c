@@ -1,7 +1,14 @@
 #include "main.h"
 
 bool read_deck(Board* board, char* deck);
+void send_player(Hub* hub, int id, char* message);
+void broadcast(Hub* hub, char* message);
+void end_game(Hub* hub, char* message);
+bool next_turn(Hub* hub);
+bool handle_move(Hub* hub, int id, char* line);
+bool receive(Hub* hub, int id);
 int game(Hub* hub);
+bool spawn_player(Hub* hub, int id);
 int initialise(Hub* hub);
 
 /**
@@ -25,7 +32,8 @@ bool read_deck(Board* board, char* deck) {
     }
 
     board->cards = calloc(board->numCards, sizeof(int));
-    for (int i = 1; i < board->numCards; ++i) {
+    board->nextCard = 0;
+    for (int i = 1; i <= board->numCards; ++i) {
         if (isalpha(buff[i]) == 0) {
             return false;
         }
@@ -35,82 +43,280 @@ bool read_deck(Board* board, char* deck) {
 }
 
 /**
- * The main game loop that handles the messages between players.
+ * Sends a message to a single player.
  * @param hub The Hub struct.
- * @return The exit code corresponding to errors encountered.
+ * @param id The id of the player to send to.
+ * @param message The message to send.
  */
-int game(Hub* hub) {
+void send_player(Hub* hub, int id, char* message) {
+    fputs(message, hub->send[id]);
+    fflush(hub->send[id]);
+}
+
+/**
+ * Sends a message to every player in the game.
+ * @param hub The Hub struct.
+ * @param message The message to send.
+ */
+void broadcast(Hub* hub, char* message) {
+    for (int i = 0; i < hub->board->numPlayers; ++i) {
+        send_player(hub, i, message);
+    }
+}
+
+/**
+ * Ends the game for all players and waits for them to exit.
+ * @param hub The Hub struct.
+ * @param message The final message to send to all players.
+ */
+void end_game(Hub* hub, char* message) {
+    broadcast(hub, message);
+    for (int i = 0; i < hub->board->numPlayers; ++i) {
+        fclose(hub->send[i]);
+        close(hub->polls[i].fd);
+    }
+    for (int i = 0; i < hub->board->numPlayers; ++i) {
+        waitpid(hub->pids[i], NULL, 0);
+    }
+}
+
+/**
+ * Gives the turn to the next player, or finishes the game once all
+ * players have reached the final stop.
+ * @param hub The Hub struct.
+ * @return True if the game is still being played.
+ */
+bool next_turn(Hub* hub) {
+    Board* board = hub->board;
+    if (game_over(board)) {
+        end_game(hub, "DONE\n");
+        output_scores(board, stdout);
+        return false;
+    }
+
+    hub->mover = next_player(board)->pid;
+    send_player(hub, hub->mover, "YT\n");
+    return true;
+}
+
+/**
+ * Handles a move message from the player whose turn it is. The move is
+ * checked, applied and then broadcast to every player.
+ * @param hub The Hub struct.
+ * @param id The id of the player that sent the message.
+ * @param line The message that was received.
+ * @return True if the move was valid.
+ */
+bool handle_move(Hub* hub, int id, char* line) {
     Board* board = hub->board;
-    char wbuffer[255];
+    char message[LINE_SIZE];
+    int effects[3];
 
-    for (int i = 0; i < board->numPlayers; ++i) {
-        write(hub->fdsend[i][1], hub->path, strlen(hub->path) + 1);
+    if (id != hub->mover || strncmp(line, "DO", 2) != 0 ||
+            !isdigit(line[2])) {
+        return false;
     }
 
-    for (int j = 0; j < board->numPlayers; ++j) {
-        read(hub->fdreceive[j][0], wbuffer, 255);
-        fprintf(stdout, "%s", wbuffer);
+    int to = atoi(&line[2]);
+    Player* player = get_player(board, id);
+    if (!legal_move(board, player, to)) {
+        return false;
     }
-    return 0;
+
+    stop_effects(board, player, to, effects);
+    player = apply_move(board, player, to, effects);
+    if (player == NULL) {
+        return false;
+    }
+
+    sprintf(message, "HAP%d,%d,%d,%d,%d\n", id, to,
+            effects[0], effects[1], effects[2]);
+    broadcast(hub, message);
+    hub->mover = -1;
+
+    print_player(player, stdout);
+    print_board(board, stdout);
+    return true;
 }
 
 /**
- * Initialises the Hub struct information used for operations.
+ * Reads the waiting input from a player and handles each complete
+ * message in it.
+ * @param hub The Hub struct.
+ * @param id The id of the player to read from.
+ * @return True if the input was read and handled.
+ */
+bool receive(Hub* hub, int id) {
+    char* line = hub->lines[id];
+    int length = hub->lineLengths[id];
+
+    int got = read(hub->polls[id].fd, line + length, LINE_SIZE - length);
+    if (got <= 0) {
+        return false;
+    }
+    length += got;
+
+    // Players announce they have started with a single '^'.
+    int start = 0;
+    if (!hub->ready[id]) {
+        if (line[0] != '^') {
+            return false;
+        }
+        hub->ready[id] = true;
+        start = 1;
+        if (++hub->numReady == hub->board->numPlayers) {
+            broadcast(hub, hub->path);
+            fflush(stdout);
+            if (!next_turn(hub)) {
+                return true;
+            }
+        }
+    }
+
+    for (int i = start; i < length; ++i) {
+        if (line[i] == '\n') {
+            line[i] = '\0';
+            if (!handle_move(hub, id, line + start) || !next_turn(hub)) {
+                return hub->mover == -1 && game_over(hub->board);
+            }
+            start = i + 1;
+        }
+    }
+
+    if (length - start >= LINE_SIZE - 1) {
+        return false;
+    }
+    memmove(line, line + start, length - start);
+    hub->lineLengths[id] = length - start;
+    return true;
+}
+
+/**
+ * The main game loop that handles the messages between players. Every
+ * player's pipe is watched at once and messages are handled as they
+ * arrive.
  * @param hub The Hub struct.
  * @return The exit code corresponding to errors encountered.
  */
-int initialise(Hub* hub) {
-    hub->fdsend = calloc(hub->board->numPlayers, sizeof(int*));
-    hub->fdreceive = calloc(hub->board->numPlayers, sizeof(int*));
-    hub->send = calloc(hub->board->numPlayers, sizeof(FILE*));
-    hub->receive = calloc(hub->board->numPlayers, sizeof(FILE*));
+int game(Hub* hub) {
+    Board* board = hub->board;
+    print_board(board, stdout);
 
-    for (int i = 0; i < hub->board->numPlayers; ++i) {
-        hub->fdsend[i] = calloc(2, sizeof(int));
-        hub->fdreceive[i] = calloc(2, sizeof(int));
-        if (pipe(hub->fdsend[i]) == -1 || pipe(hub->fdreceive[i]) == -1) {
-            fprintf(stderr, "Error starting process\n");
-            return 4;
+    while (!game_over(board) || hub->mover != -1) {
+        if (poll(hub->polls, board->numPlayers, -1) < 0) {
+            continue;
         }
 
-        pid_t pid = fork();
-        if (pid < 0) {
-            exit(1);
-        } else if (pid == 0) {
-            close(hub->fdsend[i][1]);
-            close(hub->fdreceive[i][0]);
-            fclose(stderr);
-            dup2(hub->fdsend[i][0], 0);
-            dup2(hub->fdreceive[i][1], 1);
-
-            char numPlayers = hub->board->numPlayers + '0';
-            char pid = i + '0';
-            char* args[] = {hub->players[i], &numPlayers, &pid, NULL};
-            if(execvp(args[0], args) == -1) {
-                exit(4);
+        for (int i = 0; i < board->numPlayers; ++i) {
+            if (hub->polls[i].revents == 0) {
+                continue;
             }
-        } else {
-            close(hub->fdsend[i][0]);
-            close(hub->fdreceive[i][1]);
-            hub->send[i] = fdopen(hub->fdsend[i][1], "w+");
-            hub->receive[i] = fdopen(hub->fdreceive[i][0], "r+");
-            game(hub);
-
-            int ret;
-            waitpid(pid, &ret, 0);
-
-            if (WIFEXITED(ret)) {
-                int code = WEXITSTATUS(ret);
-                if (code == 4) {
+
+            if (!receive(hub, i)) {
+                if (hub->numReady < board->numPlayers) {
                     fprintf(stderr, "Error starting process\n");
+                    end_game(hub, "EARLY\n");
                     return 4;
                 }
+                fprintf(stderr, "Communications error\n");
+                end_game(hub, "EARLY\n");
+                return 5;
+            }
+
+            if (game_over(board) && hub->mover == -1) {
+                return 0;
             }
         }
     }
     return 0;
 }
 
+/**
+ * Starts a single player process connected to the hub through a pair
+ * of pipes.
+ * @param hub The Hub struct.
+ * @param id The id of the player to start.
+ * @return True if the player process was started.
+ */
+bool spawn_player(Hub* hub, int id) {
+    hub->fdsend[id] = calloc(2, sizeof(int));
+    hub->fdreceive[id] = calloc(2, sizeof(int));
+
+    if (pipe(hub->fdsend[id]) == -1 || pipe(hub->fdreceive[id]) == -1) {
+        return false;
+    }
+
+    // The hub's ends are not inherited by the other players.
+    fcntl(hub->fdsend[id][1], F_SETFD, FD_CLOEXEC);
+    fcntl(hub->fdreceive[id][0], F_SETFD, FD_CLOEXEC);
+
+    pid_t pid = fork();
+    if (pid < 0) {
+        return false;
+    } else if (pid == 0) {
+        fclose(stderr);
+        dup2(hub->fdsend[id][0], 0);
+        dup2(hub->fdreceive[id][1], 1);
+        close(hub->fdsend[id][0]);
+        close(hub->fdreceive[id][1]);
+
+        char numPlayers[12];
+        char playerId[12];
+        sprintf(numPlayers, "%d", hub->board->numPlayers);
+        sprintf(playerId, "%d", id);
+        char* args[] = {hub->players[id], numPlayers, playerId, NULL};
+        execvp(args[0], args);
+        exit(4);
+    }
+
+    close(hub->fdsend[id][0]);
+    close(hub->fdreceive[id][1]);
+    hub->pids[id] = pid;
+    hub->send[id] = fdopen(hub->fdsend[id][1], "w");
+    hub->polls[id].fd = hub->fdreceive[id][0];
+    hub->polls[id].events = POLLIN;
+    hub->lines[id] = calloc(LINE_SIZE, sizeof(char));
+    return true;
+}
+
+/**
+ * Initialises the Hub struct information used for operations and starts
+ * every player before the game begins.
+ * @param hub The Hub struct.
+ * @return The exit code corresponding to errors encountered.
+ */
+int initialise(Hub* hub) {
+    int numPlayers = hub->board->numPlayers;
+    hub->fdsend = calloc(numPlayers, sizeof(int*));
+    hub->fdreceive = calloc(numPlayers, sizeof(int*));
+    hub->send = calloc(numPlayers, sizeof(FILE*));
+    hub->pids = calloc(numPlayers, sizeof(pid_t));
+    hub->polls = calloc(numPlayers, sizeof(struct pollfd));
+    hub->lines = calloc(numPlayers, sizeof(char*));
+    hub->lineLengths = calloc(numPlayers, sizeof(int));
+    hub->ready = calloc(numPlayers, sizeof(bool));
+    hub->numReady = 0;
+    hub->mover = -1;
+
+    // A player leaving early should not kill the hub.
+    signal(SIGPIPE, SIG_IGN);
+
+    // Each player needs a pair of descriptors in the hub.
+    struct rlimit limit;
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0) {
+        limit.rlim_cur = limit.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &limit);
+    }
+
+    for (int i = 0; i < numPlayers; ++i) {
+        if (!spawn_player(hub, i)) {
+            fprintf(stderr, "Error starting process\n");
+            return 4;
+        }
+    }
+    return game(hub);
+}
+
 /**
  * The main function that starts the dealer. Handles arguments given
  * to the program.
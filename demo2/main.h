@@ -1,19 +1,31 @@
 #ifndef ASS3_MAIN_H
 #define ASS3_MAIN_H
 
+#include <poll.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/resource.h>
 #include "board.h"
 #include "structs.h"
 
+#define LINE_SIZE 255
+
 struct Hub;
 
 typedef struct HubType {
     Board* board;
     char** players;
+    pid_t* pids;
     int** fdreceive;
     int** fdsend;
-    FILE** receive;
     FILE** send;
     char* path;
+    struct pollfd* polls;
+    char** lines;
+    int* lineLengths;
+    bool* ready;
+    int numReady;
+    int mover;
 } Hub;
 
 #endif //ASS3_MAIN_H
@@ -21,23 +21,19 @@ bool update(Game* game, char* input) {
         data[i] = atoi(value);
     }
 
-    if (data[0] > game->board->numPlayers) {
+    if (data[0] < 0 || data[0] >= game->board->numPlayers) {
         return false;
     }
 
-    Player* player = get_player(game->board, data[0]);
-    player->points += data[2];
-    player->money += data[3];
-
-    if (data[1] > game->board->numStops) {
+    if (data[1] < 0 || data[1] >= game->board->numStops) {
         return false;
     }
 
-    if (!add_card(player, data[4])) {
+    Player* player = apply_move(game->board, get_player(game->board, data[0]),
+            data[1], &data[2]);
+    if (player == NULL) {
         return false;
     }
-    player = move(get_stop(game->board, player, 0),
-            &game->board->stops[data[1]], player);
     print_player(player, stderr);
     return true;
 }
@@ -136,8 +132,8 @@ int main(int argc, char** argv) {
 
     // Incorrect process id.
     game->pid = atoi(argv[2]);
-    if (isdigit(*argv[2]) == 0 || game->pid < 0
-            || game->pid >= board->numPlayers) {
+    if (strlen(argv[2]) == 0 || strspn(argv[2], "0123456789")
+            != strlen(argv[2]) || game->pid >= board->numPlayers) {
         fprintf(stderr, "Invalid ID\n");
         return 3;
     }
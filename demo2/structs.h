@@ -9,6 +9,7 @@
 #include <sys/types.h>
 #include <sys/wait.h>
 #include <limits.h>
+#include <stdint.h>
 #include <unistd.h>
 
 struct Board;
@@ -16,22 +17,40 @@ struct Player;
 struct Stop;
 struct Game;
 
+typedef enum KindType {
+    STOP_MO,
+    STOP_DO,
+    STOP_V1,
+    STOP_V2,
+    STOP_RI,
+    STOP_BARRIER,
+    NUM_KINDS
+} Kind;
+
+#define NUM_CARDS 5
+
+#define KIND_BIT(kind) (1 << (kind))
+#define ANY_KIND ((1 << NUM_KINDS) - 1)
+
 typedef struct PlayerType {
     pid_t pid;
     int money;
     int points;
     int visited[2];
-    int* cards;
+    int cards[NUM_CARDS];
     int numCards;
     int curStop;
+    int score;
 } Player;
 
 typedef struct StopType {
-    char type[2];
+    char type[3];
+    Kind kind;
     int cap;
     bool isBarrier;
     int numPlaced;
-    Player* placed;
+    int size;
+    int* placed;
 } Stop;
 
 typedef struct BoardType {
@@ -40,6 +59,15 @@ typedef struct BoardType {
     Stop* stops;
     int numCards;
     int* cards;
+    int nextCard;
+    int rear;
+    Player* players;
+    int* location;
+    int* slot;
+    int* next[NUM_KINDS];
+    int numWords;
+    uint64_t* open;
+    uint64_t* openKind[NUM_KINDS];
 } Board;
 
 typedef struct GameType {